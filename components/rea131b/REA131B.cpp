@@ -51,9 +51,15 @@ void REA131B::setup() {
     queueSendMain();
 }
 
-// loop() does nothing except push sensor readings
+// loop() does nothing except push sensor readings and cache register reads
 void REA131B::loop() {
     RFF60Emulator::readingsQueueReceive(&_receivedReadings);
+    RFF60Emulator::ScanResult scanResult;
+    while (RFF60Emulator::scanQueueReceive(&scanResult)) {
+        for (int i = 0; i < scanResult.length; i++) {
+            _scanCache[(scanResult.offset << 8) + i] = ScannedByte{scanResult.data[i], scanResult.timestamp};
+        }
+    }
     // vTaskDelay(10);
 }
 
@@ -61,6 +67,42 @@ void REA131B::dump_config() {
       ESP_LOGCONFIG(TAG, "REA131B");
 }
 
+void REA131B::set_timeout_margin(uint32_t margin) {
+    RFF60Emulator::setTimeoutMargin(margin);
+}
+
+void REA131B::add_scan_range(uint8_t offset, uint8_t length, uint8_t priority, uint32_t interval) {
+    RFF60Emulator::addScanRange(offset, length, priority, interval);
+}
+
+void REA131B::set_scan_min_interval(uint32_t interval) {
+    RFF60Emulator::setScanMinInterval(interval);
+}
+
+void REA131B::set_scan_merge_ranges(bool enable) {
+    RFF60Emulator::setScanMergeRanges(enable);
+}
+
+void REA131B::set_scan_budget(uint32_t budget) {
+    RFF60Emulator::setScanBudget(budget);
+}
+
+void REA131B::set_low_power(bool enable) {
+    RFF60Emulator::setLowPower(enable);
+}
+
+// get a cached byte of a configured scan range, index counting from the start of the range,
+// with its age in ms; returns false if it has not been read yet
+bool REA131B::getScannedByte(uint8_t offset, uint8_t index, uint8_t *value, uint32_t *age) {
+    std::map<uint16_t, ScannedByte>::iterator it = _scanCache.find((offset << 8) + index);
+    if (it == _scanCache.end()) return false;
+    *value = it->second.value;
+    if (age) {
+        *age = millis() - it->second.timestamp;
+    }
+    return true;
+}
+
 void REA131B::on_hello_world() {
     ESP_LOGD("custom", "Hello World!");
 }
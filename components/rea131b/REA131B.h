@@ -14,7 +14,14 @@ namespace rea131b {
 class REA131B : public Component {
    public:
     RFF60Emulator *thermoMixer, *thermoMain;
-    RFF60Emulator::ThermoReadings _receivedReadings{NAN, NAN, NAN, NAN};
+    RFF60Emulator::ThermoReadings _receivedReadings{NAN, NAN, NAN, NAN, NAN};
+
+    // a byte of regulator memory from a background register read and when it was read
+    struct ScannedByte {
+        uint8_t value;
+        uint32_t timestamp;
+    };
+    std::map<uint16_t, ScannedByte> _scanCache;  // indexed by (range offset << 8) + index
 
     std::string verbose_logging_state_;
     std::string remote_control_state_;
@@ -36,8 +43,15 @@ class REA131B : public Component {
     float get_setup_priority() const override;
     static void rea131bCommsTask(void *);
     void setup() override; // setup() sets up the thermometer instances and creates the background communications task
-    void loop() override; // loop() does nothing except push sensor readings
+    void loop() override; // loop() does nothing except push sensor readings and cache register reads
     void dump_config() override;
+    void set_timeout_margin(uint32_t);
+    void add_scan_range(uint8_t, uint8_t, uint8_t, uint32_t);
+    void set_scan_min_interval(uint32_t);
+    void set_scan_merge_ranges(bool);
+    void set_scan_budget(uint32_t);
+    void set_low_power(bool);
+    bool getScannedByte(uint8_t, uint8_t, uint8_t *, uint32_t * = nullptr);
     void on_hello_world();
     void queueSendMixer();
     void queueSendMain();
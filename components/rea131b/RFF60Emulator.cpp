@@ -22,8 +22,21 @@ std::map<const std::string, RFF60Emulator::VERBOSE_LOGGING> RFF60Emulator::verbo
 bool RFF60Emulator::_apiLogging = false;
 bool RFF60Emulator::_serialLogging = false;
 bool RFF60Emulator::_remoteControl = false;
+RFF60Emulator::LatencyTracker RFF60Emulator::_latency[FRAME_TYPE_COUNT];
+uint32_t RFF60Emulator::_timeoutMargin = DEFAULT_TIMEOUT_MARGIN;
+RegisterScanner RFF60Emulator::_scanner;
+uint32_t RFF60Emulator::_scanBudget = DEFAULT_SCAN_BUDGET;
+bool RFF60Emulator::_lowPower = false;
+TaskHandle_t RFF60Emulator::_commsTask = NULL;
+uint32_t RFF60Emulator::_lastPolled = 0;
+uint32_t RFF60Emulator::_cyclePeriod = 0;
+int RFF60Emulator::_cycleCount = 0;
+int RFF60Emulator::_cycleRejects = 0;
+uint32_t RFF60Emulator::_idleTime = 0;
+float RFF60Emulator::_dutyCycle = NAN;
 
 QueueHandle_t RFF60Emulator::_readingsQueue;
+QueueHandle_t RFF60Emulator::_scanQueue;
 
 RFF60Emulator::RFF60Emulator(uint8_t addr, uint8_t pollingAddress, uint8_t regulatorAddr) {
     _addr = addr;
@@ -35,11 +48,12 @@ RFF60Emulator::RFF60Emulator(uint8_t addr, uint8_t pollingAddress, uint8_t regul
 void RFF60Emulator::setup() {
 
     _readingsQueue = xQueueCreate(1, sizeof(ThermoReadings));
+    _scanQueue = xQueueCreate(SCAN_QUEUE_LENGTH, sizeof(ScanResult));
 
     pinMode(TX_ENABLE_PIN, OUTPUT);
     digitalWrite(TX_ENABLE_PIN, LOW);
     // set up serial ports:
-    _uart.begin(9600, SWSERIAL_8S1, 23, 19, false);  // Rx = 23, Tx = 19
+    _uart.begin(9600, SWSERIAL_8S1, RX_PIN, TX_PIN, false);
     _uart.setTimeout(POLLING_TIMEOUT);
     // clear the UART buffers
     while (_uart.available() > 0) {
@@ -64,6 +78,8 @@ RFF60Emulator *RFF60Emulator::waitUntilPolled() {
 
     static TickType_t taskDelay = 10;
 
+    idleUntilPollingWindow();
+
     _uart.setTimeout(READ_TIMEOUT);
 
     for (;;) {
@@ -87,38 +103,138 @@ RFF60Emulator *RFF60Emulator::waitUntilPolled() {
 
         if (!_remoteControl) {
             ESP_LOGD("custom", "Remote control is disabled");
+            _cycleCount = 0;
             vTaskDelay(1000);
             return 0;
         }
 
-        recvLen = receiveData(_recvBuf, 1024);
-        if (recvLen == 1) {
-            it = _instances.find(_recvBuf[0]);
-            if (it != _instances.end()) {
-                if (_recvBuf[0] == prevAddr) {  // if same address twice
-                    break;
+        // in low power mode, only read once something has arrived rather than waiting out READ_TIMEOUT
+        if (!_lowPower || _uart.available() > 0) {
+            recvLen = receiveData(_recvBuf, 1024);
+            if (recvLen == 1) {
+                it = _instances.find(_recvBuf[0]);
+                if (it != _instances.end()) {
+                    if (_recvBuf[0] == prevAddr) {  // if same address twice
+                        break;
+                    }
+                    prevAddr = _recvBuf[0];
                 }
-                prevAddr = _recvBuf[0];
             }
         }
 
+        uint32_t delayStart = millis();
         vTaskDelay(taskDelay);
+        _idleTime += millis() - delayStart;
     }
 
+    recordCycle(millis());
     _uart.setTimeout(LONG_TIMEOUT);
     return it->second;
 }
 
+// learn the regulator's polling period from the times we are polled and update the duty cycle
+void RFF60Emulator::recordCycle(uint32_t now) {
+    uint32_t period = now - _lastPolled;
+    if (_cycleCount > 0 && period > 0) {
+        float dutyCycle = 100.0f * (period - std::min(_idleTime, period)) / period;
+        _dutyCycle = std::isnan(_dutyCycle) ? dutyCycle : (_dutyCycle * 7 + dutyCycle) / 8;
+
+        if (_cycleCount == 1) {
+            _cyclePeriod = period;
+            _cycleCount++;
+        } else if (period < _cyclePeriod * 3 / 2) {  // a longer period means that a polling was missed
+            _cyclePeriod = (_cyclePeriod * 7 + period) / 8;
+            if (_cycleCount < CYCLE_WARMUP) _cycleCount++;
+            _cycleRejects = 0;
+        } else if (++_cycleRejects >= MAX_CYCLE_REJECTS) {
+            ESP_LOGD("custom", "Polling period changed, relearning it");
+            _cycleCount = 1;
+            _cycleRejects = 0;
+        }
+    } else {
+        _cycleCount = 1;
+    }
+    _lastPolled = now;
+    _idleTime = 0;
+}
+
+// in low power mode, block the task until shortly before the regulator is expected to poll again;
+// bus activity wakes the task, which stops waiting if it hears one of its polling addresses
+void RFF60Emulator::idleUntilPollingWindow() {
+    if (!_lowPower || _cycleCount < CYCLE_WARMUP) return;
+    uint32_t wakeTime = _lastPolled + _cyclePeriod - POLLING_WINDOW_GUARD;
+    if ((int32_t)(wakeTime - millis()) <= 0) return;
+
+    ESP_LOGD("custom", "Idling for %d ms", (int)(wakeTime - millis()));
+    enableRxWake(true);
+    while ((int32_t)(wakeTime - millis()) > 0) {
+        uint32_t waitStart = millis();
+        bool rxWake = ulTaskNotifyTake(pdTRUE, wakeTime - waitStart) > 0;
+        _idleTime += millis() - waitStart;
+        if (rxWake) {
+            enableRxWake(false);
+            if (listenAfterRxWake()) {
+                ESP_LOGD("custom", "Polled earlier than predicted");
+                return;
+            }
+            enableRxWake(true);
+        }
+    }
+    enableRxWake(false);
+}
+
+// after an RX wake, listen for a while and return true if one of our polling addresses is on the bus;
+// as in waitUntilPolled() the address has to be received twice in a row, so that data bytes of
+// other frames that happen to match it are not taken for a polling
+bool RFF60Emulator::listenAfterRxWake() {
+    uint32_t listenStart = millis();
+    int prevByte = -1;
+    while (millis() - listenStart < RX_WAKE_LISTEN) {
+        int byte = _uart.read();
+        if (byte < 0) {
+            vTaskDelay(1);
+            continue;
+        }
+        if (byte == prevByte && _instances.find((uint8_t)byte) != _instances.end()) {
+            return true;
+        }
+        prevByte = byte;
+    }
+    return false;
+}
+
+// hand the RX pin over from the software serial to a wake-up interrupt while idling, and back
+void RFF60Emulator::enableRxWake(bool enable) {
+    if (enable) {
+        ulTaskNotifyTake(pdTRUE, 0);
+        _commsTask = xTaskGetCurrentTaskHandle();
+        _uart.enableRx(false);
+        attachInterrupt(RX_PIN, onRxWake, FALLING);
+    } else {
+        detachInterrupt(RX_PIN);
+        _uart.enableRx(true);
+    }
+}
+
+// wakes the comms task on a start bit; only calls IRAM-safe FreeRTOS functions,
+// and being edge triggered it does not need to disable itself
+void IRAM_ATTR RFF60Emulator::onRxWake() {
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(_commsTask, &higherPriorityTaskWoken);
+    if (higherPriorityTaskWoken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
 // do the data exchange with the regulator(s) and simulated thermostat(s) with an initial header exchange
 int RFF60Emulator::doDataExchangeWithHeader() {
-    _uart.setTimeout(LONG_TIMEOUT);
     size_t recvLen = 0;
     // send 2 bytes {06 _addr}
     uint8_t msg_06_addr[]{0x06, 0};
     msg_06_addr[1] = _addr7e;
     transmitData(msg_06_addr, 2);
     // receive 9 bytes, _skipThermostatsFlag = byte 5 & 0x01
-    recvLen = receiveData(_recvBuf, 9);
+    recvLen = receiveFrame(_recvBuf, 9, FRAME_HEADER_REPLY);
     if (!isMessageValid(_recvBuf, recvLen)) {
         return 1;
     };
@@ -131,7 +247,6 @@ int RFF60Emulator::doDataExchangeWithHeader() {
 
 // do the data exchange with the regulator(s) and simulated thermostat(s)
 int RFF60Emulator::doDataExchange() {
-    _uart.setTimeout(LONG_TIMEOUT);
     size_t recvLen = 0;
     // send 1 byte {06}
     uint8_t msg_06[]{0x06};
@@ -141,7 +256,7 @@ int RFF60Emulator::doDataExchange() {
     uint8_t msg_90[]{0x90};
     transmitData(msg_90, 1, PARITY_MARK);
     // receive 2 bytes {06 90}
-    recvLen = receiveData(_recvBuf, 2);
+    recvLen = receiveFrame(_recvBuf, 2, FRAME_TOKEN_REPLY);
     if (!isReplyValid(_recvBuf, 2)) return 1;
     vTaskDelay(1);
     // send 9 bytes {82 _addr 10 01 02 10 CRC 03}
@@ -150,10 +265,10 @@ int RFF60Emulator::doDataExchange() {
     insertCRC(msg4, 1, 5);
     transmitData(msg4, 9);
     // receive 1 byte {06}
-    recvLen = receiveData(_recvBuf, 1);
+    recvLen = receiveFrame(_recvBuf, 1, FRAME_ACK);
     if (!isReplyValid(_recvBuf, 1)) return 1;
     // receive 24 bytes, _reducedTemp = byte 16, _comfortTemp = byte 20
-    recvLen = receiveData(_recvBuf, 24);
+    recvLen = receiveFrame(_recvBuf, 24, FRAME_READINGS_REPLY);
     if (!isMessageValid(_recvBuf, recvLen)) {
         return 1;
     };
@@ -165,6 +280,7 @@ int RFF60Emulator::doDataExchange() {
     readings.hotWaterTemp = _recvBuf[11] / 2.0f;
     readings.mixerTemp = _recvBuf[14] / 2.0f;
     readings.boilerTemp = _recvBuf[15] / 2.0f;
+    readings.commsDutyCycle = _dutyCycle;
     _reducedTemp = _recvBuf[16];
     _comfortTemp = _recvBuf[20];
     readingsQueueSend(&readings);
@@ -174,7 +290,7 @@ int RFF60Emulator::doDataExchange() {
     // send 1 byte {90}
     transmitData(msg_90, 1, PARITY_MARK);
     // receive 2 bytes {06 90}
-    recvLen = receiveData(_recvBuf, 2);
+    recvLen = receiveFrame(_recvBuf, 2, FRAME_TOKEN_REPLY);
     if (!isReplyValid(_recvBuf, 2)) return 1;
     vTaskDelay(1);
     // send 9 bytes {82 _addr 10 01 06 28 CRC 03}
@@ -183,11 +299,11 @@ int RFF60Emulator::doDataExchange() {
     insertCRC(msg6, 1, 5);
     transmitData(msg6, 9);
     // receive 1 byte {06}
-    recvLen = receiveData(_recvBuf, 1);
+    recvLen = receiveFrame(_recvBuf, 1, FRAME_ACK);
     if (!isReplyValid(_recvBuf, 1)) return 1;
     // receive 48 bytes, save in message buffer
     uint8_t msg7[48];
-    recvLen = receiveData(msg7, 48);
+    recvLen = receiveFrame(msg7, 48, FRAME_SETTINGS_REPLY);
     if (!isMessageValid(msg7, recvLen)) {
         return 1;
     };
@@ -197,7 +313,7 @@ int RFF60Emulator::doDataExchange() {
     // send 1 byte {90}
     transmitData(msg_90, 1, PARITY_MARK);
     // receive 2 bytes {06 90}
-    recvLen = receiveData(_recvBuf, 2);
+    recvLen = receiveFrame(_recvBuf, 2, FRAME_TOKEN_REPLY);
     if (!isReplyValid(_recvBuf, 2)) return 1;
     vTaskDelay(1);
     // modify message buffer:
@@ -221,13 +337,106 @@ int RFF60Emulator::doDataExchange() {
     // send message buffer
     transmitData(msg7, 48);
     // receive 1 byte {06}
-    recvLen = receiveData(_recvBuf, 1);
+    recvLen = receiveFrame(_recvBuf, 1, FRAME_ACK);
     if (!isReplyValid(_recvBuf, 1)) return 1;
     ESP_LOGD("custom", "Address %02x completed data exchange", _addr);
     // Start polling
     return poll();
 }
 
+// read scheduled register ranges for as long as each read is sure to finish within the scan budget
+void RFF60Emulator::doScanReads() {
+    // verbose logging takes an unbounded time in printHex(), so the budget could not be kept
+    if (_scanner.isEmpty() || _apiLogging || _serialLogging) return;
+    uint32_t scanStart = millis();
+    uint32_t deadline = scanStart + _scanBudget;
+    // the receives of a read end early enough to leave time for draining the bus after a failure
+    uint32_t readDeadline = deadline - POLLING_TIMEOUT;
+    RegisterScanner::ScanRequest request;
+    for (;;) {
+        uint32_t used = millis() - scanStart + scanReadDuration(0);
+        if (used >= _scanBudget) return;
+        // the longest read whose reply still fits in the rest of the budget
+        int maxLength = (_scanBudget - used) * 1000 / RX_BYTE_TIME_US;
+        if (!_scanner.nextRequest(millis(), std::min(maxLength, (int)RegisterScanner::MAX_READ_LENGTH), &request)) return;
+        if (doScanRead(request, readDeadline) != 0) {
+            ESP_LOGD("custom", "Address %02x register read at 0x%02x failed", _addr, request.offset);
+            drainBus(deadline);
+            return;
+        }
+    }
+}
+
+// worst case duration of a register read in ms: the fixed delays, the 9 byte request,
+// the time to the first byte of each reply, the wire time of the reply to the read
+// and the quiet time waited for by drainBus() if the read fails
+uint32_t RFF60Emulator::scanReadDuration(const int length) {
+    static const int printHexCount = 5;
+    return 6 + 1 + 8 * TX_BYTE_DELAY + printHexCount * (LOGGING_SUBSTITUTE_DELAY_API + LOGGING_SUBSTITUTE_DELAY_SERIAL) +
+           frameTimeout(FRAME_SCAN_TOKEN_REPLY) + frameTimeout(FRAME_SCAN_ACK) + frameTimeout(FRAME_SCAN_REPLY) +
+           ((length + 8) * RX_BYTE_TIME_US + 999) / 1000 + POLLING_TIMEOUT;
+}
+
+// returns the ms left until the deadline, or 0 if it has passed
+uint32_t RFF60Emulator::timeUntil(const uint32_t deadline) {
+    int32_t remaining = (int32_t)(deadline - millis());
+    return remaining > 0 ? remaining : 0;
+}
+
+// after a failed register read, wait until the bus has been quiet for POLLING_TIMEOUT before polling
+// continues, so as not to transmit over a late reply, but no longer than the deadline
+void RFF60Emulator::drainBus(const uint32_t deadline) {
+    uint32_t quietStart = millis();
+    while (millis() - quietStart < POLLING_TIMEOUT && timeUntil(deadline) > 0) {
+        if (_uart.read() >= 0) {
+            quietStart = millis();
+        } else {
+            vTaskDelay(1);
+        }
+    }
+}
+
+// read a range of regulator memory with the same request as msg4 and msg6 and queue the result
+int RFF60Emulator::doScanRead(const RegisterScanner::ScanRequest &request, const uint32_t deadline) {
+    size_t recvLen = 0;
+    vTaskDelay(6);
+    // send 1 byte {90}
+    uint8_t msg_90[]{0x90};
+    transmitData(msg_90, 1, PARITY_MARK);
+    // receive 2 bytes {06 90}
+    recvLen = receiveFrame(_recvBuf, 2, FRAME_SCAN_TOKEN_REPLY, timeUntil(deadline));
+    if (recvLen != 2 || !isReplyValid(_recvBuf, 2)) return 1;
+    vTaskDelay(1);
+    // send 9 bytes {82 _addr 10 01 offset length CRC 03}
+    uint8_t msg[]{0x82, 0, 0x10, 0x01, 0, 0, 0, 0, 0x03};
+    msg[1] = _addr;
+    msg[4] = request.offset;
+    msg[5] = request.length;
+    insertCRC(msg, 1, 5);
+    transmitData(msg, 9);
+    // receive 1 byte {06}
+    recvLen = receiveFrame(_recvBuf, 1, FRAME_SCAN_ACK, timeUntil(deadline));
+    if (recvLen != 1 || !isReplyValid(_recvBuf, 1)) return 1;
+    // receive length + 8 bytes {82 10 20 length offset data CRC 03}
+    size_t replyLen = request.length + 8;
+    recvLen = receiveFrame(_recvBuf, replyLen, FRAME_SCAN_REPLY, timeUntil(deadline));
+    if (recvLen != replyLen || !isMessageValid(_recvBuf, recvLen)) return 1;
+    uint8_t replyHeader[]{0x82, 0x10, 0x20, request.length, request.offset};
+    if (memcmp(_recvBuf, replyHeader, 5)) return 1;
+
+    // queue each configured range separately, so that it is cached under its own offset
+    ScanResult result;
+    result.timestamp = millis();
+    for (const RegisterScanner::ScanPart &part : request.parts) {
+        result.offset = part.offset;
+        result.length = part.length;
+        memcpy(result.data, _recvBuf + 5 + part.start, part.length);
+        scanQueueSend(&result);
+    }
+    ESP_LOGD("custom", "Address %02x read 0x%02x bytes at 0x%02x", _addr, request.length, request.offset);
+    return 0;
+}
+
 // poll the possible regulator and thermostat addresses for replies
 int RFF60Emulator::poll() {
     size_t recvLen = 0;
@@ -245,6 +454,18 @@ int RFF60Emulator::poll() {
     int startIndex = 0;
     startIndex = _addr - 0x21;
 
+    // use the rest of the slot for background register reads, but only after the last thermostat's
+    // exchange in the cycle, so that they never delay another exchange and run only once per cycle
+    bool lastInstance = true;
+    for (int i = startIndex; i < addressesLength; i++) {
+        if (addresses[i] != _addr7e && _instances.find(addresses[i]) != _instances.end()) {
+            lastInstance = false;
+        }
+    }
+    if (lastInstance) {
+        doScanReads();
+    }
+
     ESP_LOGD("custom", "Address %02x polling...", _addr);
 
     bool replyReceived = false;
@@ -296,7 +517,7 @@ int RFF60Emulator::poll() {
 // transmit a string of bytes on the serial port
 void RFF60Emulator::transmitData(const uint8_t *buf, const size_t len, const Parity parity) {
     TickType_t xLastWakeTime;
-    const TickType_t waitTicks = 3;
+    const TickType_t waitTicks = TX_BYTE_DELAY;
     BaseType_t xWasDelayed;
     digitalWrite(TX_ENABLE_PIN, HIGH);
     xLastWakeTime = xTaskGetTickCount();
@@ -329,6 +550,90 @@ size_t RFF60Emulator::receiveData(uint8_t *buf, size_t len) {
     return recvLen;
 }
 
+// receive a frame from the regulator, timing out at a margin above its learned response latency;
+// the latency is the time to the first byte, the rest of the frame is limited by the gap between bytes
+// and the whole frame by maxDuration
+size_t RFF60Emulator::receiveFrame(uint8_t *buf, const size_t len, const FRAME_TYPE type, const uint32_t maxDuration) {
+    uint32_t timeout = frameTimeout(type);
+    uint32_t start = millis();
+    uint32_t lastByte = start;
+    uint32_t latency = 0;
+    size_t recvLen = 0;
+    while (recvLen < len) {
+        int byte = _uart.read();
+        if (byte >= 0) {
+            if (recvLen == 0) latency = millis() - start;
+            buf[recvLen++] = (uint8_t)byte;
+            lastByte = millis();
+        } else if (millis() - lastByte >= timeout || millis() - start >= maxDuration) {
+            break;
+        } else {
+            vTaskDelay(1);
+        }
+    }
+    if (recvLen == len) {
+        recordLatency(type, latency);
+    } else {
+        ESP_LOGD("custom", "Frame type %d incomplete, %d of %d bytes after %d ms (timeout %d ms)",
+                 type, (int)recvLen, (int)len, (int)(millis() - start), (int)timeout);
+        recordFailure(type);
+    }
+    if (recvLen > 0) {
+        printHex(buf, recvLen, "1> ");
+    }
+    return recvLen;
+}
+
+// returns the receive timeout for a frame type, or LONG_TIMEOUT while warming up
+uint32_t RFF60Emulator::frameTimeout(const FRAME_TYPE type) {
+    LatencyTracker &tracker = _latency[type];
+    uint32_t timeout = LONG_TIMEOUT;
+    if (tracker.count >= LATENCY_WARMUP_SAMPLES) {
+        timeout = std::max<uint32_t>(tracker.tail + _timeoutMargin, READ_TIMEOUT);
+        timeout = std::min<uint32_t>(timeout, LONG_TIMEOUT);
+    }
+    // background read frames have their own trackers, so that failed reads do not disturb the
+    // exchange, but they are capped by the timeouts of the same frames in the exchange
+    switch (type) {
+        case FRAME_SCAN_TOKEN_REPLY:
+            return std::min(timeout, frameTimeout(FRAME_TOKEN_REPLY));
+        case FRAME_SCAN_ACK:
+            return std::min(timeout, frameTimeout(FRAME_ACK));
+        case FRAME_SCAN_REPLY:
+            return std::min(timeout, frameTimeout(FRAME_SETTINGS_REPLY));
+        default:
+            return timeout;
+    }
+}
+
+// add a successful receive to the window and update the tail percentile
+void RFF60Emulator::recordLatency(const FRAME_TYPE type, const uint32_t elapsed) {
+    LatencyTracker &tracker = _latency[type];
+    tracker.samples[tracker.next] = (uint16_t)std::min<uint32_t>(elapsed, LONG_TIMEOUT);
+    tracker.next = (tracker.next + 1) % LATENCY_WINDOW;
+    if (tracker.count < LATENCY_WINDOW) tracker.count++;
+    tracker.consecutiveFailures = 0;
+
+    uint16_t sorted[LATENCY_WINDOW];
+    std::copy(tracker.samples, tracker.samples + tracker.count, sorted);
+    int index = (tracker.count - 1) * LATENCY_PERCENTILE / 100;
+    std::nth_element(sorted, sorted + index, sorted + tracker.count);
+    tracker.tail = sorted[index];
+}
+
+// after repeated timeouts, discard the learned latencies so that LONG_TIMEOUT is used until they are relearned
+void RFF60Emulator::recordFailure(const FRAME_TYPE type) {
+    LatencyTracker &tracker = _latency[type];
+    if (++tracker.consecutiveFailures >= MAX_CONSECUTIVE_FAILURES) {
+        if (tracker.count > 0) {
+            ESP_LOGD("custom", "Frame type %d: %d timeouts in a row, reverting to default timeout", type, tracker.consecutiveFailures);
+        }
+        tracker.count = 0;
+        tracker.next = 0;
+        tracker.consecutiveFailures = 0;
+    }
+}
+
 // print out a string of bytes in hex with an added prefix string
 void RFF60Emulator::printHex(const uint8_t *buf, size_t len, const char *prefix = "") {
     std::ostringstream stream("", std::ios_base::app);
@@ -441,12 +746,44 @@ void RFF60Emulator::readingsQueueSend(ThermoReadings *pReadings) {
 
 bool RFF60Emulator::readingsQueueReceive(ThermoReadings *pReadings) {
     if (xQueueReceive(_readingsQueue, pReadings, 0) == pdTRUE) {
-        ESP_LOGD("custom", "received readings:\n  outsideTemp: %f\n  hotWaterTemp: %f\n  mixerTemp: %f\n  boilerTemp: %f",
-                 pReadings->outsideTemp, pReadings->hotWaterTemp, pReadings->mixerTemp, pReadings->boilerTemp);
+        ESP_LOGD("custom", "received readings:\n  outsideTemp: %f\n  hotWaterTemp: %f\n  mixerTemp: %f\n  boilerTemp: %f\n  commsDutyCycle: %f",
+                 pReadings->outsideTemp, pReadings->hotWaterTemp, pReadings->mixerTemp, pReadings->boilerTemp, pReadings->commsDutyCycle);
         return true;
     }
     return false;
 }
 
+void RFF60Emulator::setTimeoutMargin(uint32_t margin) {
+    _timeoutMargin = margin;
+}
+
+void RFF60Emulator::addScanRange(uint8_t offset, uint8_t length, uint8_t priority, uint32_t interval) {
+    _scanner.addRange(offset, length, priority, interval);
+}
+
+void RFF60Emulator::setScanMinInterval(uint32_t interval) {
+    _scanner.setMinInterval(interval);
+}
+
+void RFF60Emulator::setScanMergeRanges(bool enable) {
+    _scanner.setMergeRanges(enable);
+}
+
+void RFF60Emulator::setScanBudget(uint32_t budget) {
+    _scanBudget = budget;
+}
+
+void RFF60Emulator::setLowPower(bool enable) {
+    _lowPower = enable;
+}
+
+void RFF60Emulator::scanQueueSend(ScanResult *pResult) {
+    xQueueSend(_scanQueue, pResult, 0);
+}
+
+bool RFF60Emulator::scanQueueReceive(ScanResult *pResult) {
+    return xQueueReceive(_scanQueue, pResult, 0) == pdTRUE;
+}
+
 }  // namespace rea131b
 }  // namespace esphome
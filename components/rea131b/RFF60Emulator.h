@@ -9,13 +9,17 @@
 #include <freertos/queue.h>
 #include <sys/time.h>
 
+#include <algorithm>
 #include <bitset>
+#include <cmath>
 #include <exception>
 #include <iomanip>
 #include <ios>
 #include <map>
 #include <sstream>
 
+#include "RegisterScanner.h"
+
 namespace esphome {
 namespace rea131b {
 
@@ -36,6 +40,19 @@ class RFF60Emulator {
         VERBOSE_BOTH = 3
     };
 
+    // frame types received from the regulator, each with its own learned response timeout
+    enum FRAME_TYPE {
+        FRAME_HEADER_REPLY = 0,  // 9 byte reply to {06 _addr}
+        FRAME_TOKEN_REPLY,       // {06 90} reply to {90}
+        FRAME_ACK,               // {06} acknowledging a message
+        FRAME_READINGS_REPLY,    // 24 byte reply to msg4
+        FRAME_SETTINGS_REPLY,    // 48 byte reply to msg6
+        FRAME_SCAN_TOKEN_REPLY,  // {06 90} reply to {90} before a background register read
+        FRAME_SCAN_ACK,          // {06} acknowledging a background register read
+        FRAME_SCAN_REPLY,        // reply to a background register read
+        FRAME_TYPE_COUNT
+    };
+
     static std::map<const std::string, RFF60Emulator::SELECTOR_POSN> selectorPosnMap;
     static std::map<const std::string, RFF60Emulator::VERBOSE_LOGGING> verboseLoggingMap;
 
@@ -53,6 +70,14 @@ class RFF60Emulator {
         float hotWaterTemp;
         float mixerTemp;
         float boilerTemp;
+        float commsDutyCycle;  // % of the time the comms task is not waiting
+    };
+
+    struct ScanResult {
+        uint8_t offset;
+        uint8_t length;
+        uint8_t data[RegisterScanner::MAX_READ_LENGTH];
+        uint32_t timestamp;
     };
 
     RFF60Emulator(uint8_t, uint8_t, uint8_t);
@@ -75,11 +100,44 @@ class RFF60Emulator {
     bool settingsQueueReceive();
     static void readingsQueueSend(ThermoReadings *);
     static bool readingsQueueReceive(ThermoReadings *);
+    static void setTimeoutMargin(uint32_t);
+    static void addScanRange(uint8_t, uint8_t, uint8_t, uint32_t);
+    static void setScanMinInterval(uint32_t);
+    static void setScanMergeRanges(bool);
+    static void setScanBudget(uint32_t);
+    static void setLowPower(bool);
+    static bool scanQueueReceive(ScanResult *);
 
    private:
+    static const int LATENCY_WINDOW = 32;
+
+    // recent response latencies (time to first byte) of one frame type and the tail percentile learned from them
+    struct LatencyTracker {
+        uint16_t samples[LATENCY_WINDOW];
+        uint8_t count;
+        uint8_t next;
+        uint8_t consecutiveFailures;
+        uint16_t tail;
+    };
+
     static void transmitData(const uint8_t *, const size_t, const Parity = PARITY_SPACE);
     static void transmitByte(const uint8_t, const Parity);
     static size_t receiveData(uint8_t *, const size_t);
+    static size_t receiveFrame(uint8_t *, const size_t, const FRAME_TYPE, const uint32_t = UINT32_MAX);
+    static uint32_t frameTimeout(const FRAME_TYPE);
+    static void recordLatency(const FRAME_TYPE, const uint32_t);
+    static void recordFailure(const FRAME_TYPE);
+    static uint32_t scanReadDuration(const int);
+    static uint32_t timeUntil(const uint32_t);
+    static void drainBus(const uint32_t);
+    void doScanReads();
+    int doScanRead(const RegisterScanner::ScanRequest &, const uint32_t);
+    static void scanQueueSend(ScanResult *);
+    static void recordCycle(uint32_t);
+    static void idleUntilPollingWindow();
+    static bool listenAfterRxWake();
+    static void enableRxWake(bool);
+    static void IRAM_ATTR onRxWake();
     static void printHex(const uint8_t *, size_t, const char *);
     static void insertCRC(uint8_t *, int, int);
     static bool checkCRC(uint8_t *, int, int);
@@ -105,6 +163,8 @@ class RFF60Emulator {
 
     static SoftwareSerial _uart;
     static const int TX_ENABLE_PIN = 22;
+    static const int RX_PIN = 23;
+    static const int TX_PIN = 19;
     static uint8_t _recvBuf[];
 
     static CRC16 *_crc;
@@ -112,6 +172,36 @@ class RFF60Emulator {
     static const int POLLING_TIMEOUT = 70;
     static const int READ_TIMEOUT = 10;
 
+    static const int LATENCY_PERCENTILE = 95;      // tail of the latency distribution used for the timeout
+    static const int LATENCY_WARMUP_SAMPLES = 8;   // use LONG_TIMEOUT until this many replies have been timed
+    static const int MAX_CONSECUTIVE_FAILURES = 2; // forget the learned latencies after this many timeouts in a row
+    static const int DEFAULT_TIMEOUT_MARGIN = 20;
+    static const int TX_BYTE_DELAY = 3;
+    static const int DEFAULT_SCAN_BUDGET = 300;
+    static const int RX_BYTE_TIME_US = 1146;  // 11 bits at 9600 baud
+    static const int SCAN_QUEUE_LENGTH = 8;
+
+    static LatencyTracker _latency[FRAME_TYPE_COUNT];
+    static uint32_t _timeoutMargin;
+
+    static RegisterScanner _scanner;
+    static uint32_t _scanBudget;
+    static QueueHandle_t _scanQueue;
+
+    static const int CYCLE_WARMUP = 3;            // cycles to observe before idling
+    static const int MAX_CYCLE_REJECTS = 3;       // relearn the cycle period after this many outliers in a row
+    static const int POLLING_WINDOW_GUARD = 300;  // wake up this many ms before the predicted polling
+    static const int RX_WAKE_LISTEN = 300;        // time to listen for our polling address after an RX wake
+
+    static bool _lowPower;
+    static TaskHandle_t _commsTask;
+    static uint32_t _lastPolled;
+    static uint32_t _cyclePeriod;
+    static int _cycleCount;
+    static int _cycleRejects;
+    static uint32_t _idleTime;
+    static float _dutyCycle;
+
     static const int LOGGING_SUBSTITUTE_DELAY_API = 3;
     static const int LOGGING_SUBSTITUTE_DELAY_SERIAL = 1;
 
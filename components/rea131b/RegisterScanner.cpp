@@ -0,0 +1,87 @@
+#include "RegisterScanner.h"
+
+namespace esphome {
+namespace rea131b {
+
+// add a range of regulator memory to be read in the background
+void RegisterScanner::addRange(uint8_t offset, uint8_t length, uint8_t priority, uint32_t interval) {
+    _ranges.push_back(ScanRange{offset, length, priority, interval, 0, false});
+}
+
+void RegisterScanner::setMinInterval(uint32_t interval) {
+    _minInterval = interval;
+}
+
+void RegisterScanner::setMergeRanges(bool enable) {
+    _mergeRanges = enable;
+}
+
+bool RegisterScanner::isEmpty() {
+    return _ranges.empty();
+}
+
+// returns true if a range has never been read or its interval has elapsed
+bool RegisterScanner::isDue(const ScanRange &range, uint32_t now) {
+    return !range.readOnce || (now - range.lastRead >= range.interval);
+}
+
+// choose the next read of at most maxLength bytes: the due range with the highest priority
+// (oldest first among equals), extended with adjacent due ranges if merging is enabled
+bool RegisterScanner::nextRequest(uint32_t now, int maxLength, ScanRequest *request) {
+    if (_requested && (now - _lastRequest < _minInterval)) return false;
+
+    int best = -1;
+    for (int i = 0; i < _ranges.size(); i++) {
+        const ScanRange &range = _ranges[i];
+        if (!isDue(range, now) || range.length > maxLength) continue;
+        if (best < 0 || range.priority > _ranges[best].priority) {
+            best = i;
+        } else if (range.priority == _ranges[best].priority) {
+            bool older = !range.readOnce || (_ranges[best].readOnce && range.lastRead < _ranges[best].lastRead);
+            if (older) best = i;
+        }
+    }
+    if (best < 0) return false;
+
+    uint8_t offset = _ranges[best].offset;
+    int length = _ranges[best].length;
+    std::vector<bool> merged(_ranges.size(), false);
+    merged[best] = true;
+    bool extended = _mergeRanges;
+    while (extended) {
+        extended = false;
+        for (int i = 0; i < _ranges.size(); i++) {
+            const ScanRange &range = _ranges[i];
+            if (merged[i] || !isDue(range, now) || length + range.length > maxLength) continue;
+            // range starts where the request ends
+            if ((length % OFFSET_UNIT == 0) && (range.offset == offset + length / OFFSET_UNIT)) {
+                length += range.length;
+                merged[i] = extended = true;
+            // range ends where the request starts
+            } else if ((range.length % OFFSET_UNIT == 0) && (range.offset + range.length / OFFSET_UNIT == offset)) {
+                offset = range.offset;
+                length += range.length;
+                merged[i] = extended = true;
+            }
+        }
+    }
+
+    request->offset = offset;
+    request->length = length;
+    request->parts.clear();
+    // mark the ranges as read whether or not the read succeeds, so that a failing range
+    // is retried at its normal interval rather than in every slot
+    for (int i = 0; i < _ranges.size(); i++) {
+        if (!merged[i]) continue;
+        ScanRange &range = _ranges[i];
+        request->parts.push_back(ScanPart{range.offset, (uint8_t)((range.offset - offset) * OFFSET_UNIT), range.length});
+        range.lastRead = now;
+        range.readOnce = true;
+    }
+    _lastRequest = now;
+    _requested = true;
+    return true;
+}
+
+}  // namespace rea131b
+}  // namespace esphome
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace rea131b {
+
+// schedules background reads of regulator memory ranges into the spare time of the bus slot
+class RegisterScanner {
+   public:
+    // the offset of a read request might count 8 byte blocks (msg4 reads 0x10 bytes at offset 0x02
+    // and msg6 reads 0x28 bytes at offset 0x06), but this is unconfirmed, so merging is off by default
+    static const int OFFSET_UNIT = 8;
+    static const int MAX_READ_LENGTH = 0x28;  // longest read seen on the bus (msg6)
+
+    struct ScanRange {
+        uint8_t offset;
+        uint8_t length;
+        uint8_t priority;   // higher is read first
+        uint32_t interval;  // minimum time between reads of this range in ms
+        uint32_t lastRead;
+        bool readOnce;
+    };
+
+    // a configured range within a request, starting at byte start of the reply data
+    struct ScanPart {
+        uint8_t offset;
+        uint8_t start;
+        uint8_t length;
+    };
+
+    struct ScanRequest {
+        uint8_t offset;
+        uint8_t length;
+        std::vector<ScanPart> parts;
+    };
+
+    void addRange(uint8_t, uint8_t, uint8_t, uint32_t);
+    void setMinInterval(uint32_t);
+    void setMergeRanges(bool);
+    bool isEmpty();
+    bool nextRequest(uint32_t, int, ScanRequest *);
+
+   private:
+    bool isDue(const ScanRange &, uint32_t);
+
+    std::vector<ScanRange> _ranges;
+    uint32_t _minInterval = 5000;  // minimum time between any two reads in ms
+    uint32_t _lastRequest = 0;
+    bool _requested = false;
+    bool _mergeRanges = false;
+};
+
+}  // namespace rea131b
+}  // namespace esphome
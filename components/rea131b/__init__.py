@@ -5,10 +5,45 @@ from esphome.const import CONF_ID
 rea131b_ns = cg.esphome_ns.namespace("rea131b")
 REA131B = rea131b_ns.class_("REA131B", cg.Component)
 
+CONF_TIMEOUT_MARGIN = "timeout_margin"
+CONF_SCAN_RANGES = "scan_ranges"
+CONF_SCAN_MIN_INTERVAL = "scan_min_interval"
+CONF_SCAN_BUDGET = "scan_budget"
+CONF_SCAN_MERGE_RANGES = "scan_merge_ranges"
+CONF_LOW_POWER = "low_power"
+CONF_OFFSET = "offset"
+CONF_LENGTH = "length"
+CONF_PRIORITY = "priority"
+CONF_INTERVAL = "interval"
+
+# longest register read seen on the bus, see RegisterScanner::MAX_READ_LENGTH
+MAX_READ_LENGTH = 0x28
+
+SCAN_RANGE_SCHEMA = cv.Schema({
+    cv.Required(CONF_OFFSET): cv.hex_uint8_t,
+    cv.Required(CONF_LENGTH): cv.int_range(min=1, max=MAX_READ_LENGTH),
+    cv.Optional(CONF_PRIORITY, default=0): cv.uint8_t,
+    cv.Optional(CONF_INTERVAL, default="60s"): cv.positive_time_period_milliseconds,
+})
+
 CONFIG_SCHEMA = cv.Schema({
     cv.GenerateID(): cv.declare_id(REA131B),
+    cv.Optional(CONF_TIMEOUT_MARGIN, default="20ms"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_SCAN_RANGES, default=[]): cv.ensure_list(SCAN_RANGE_SCHEMA),
+    cv.Optional(CONF_SCAN_MIN_INTERVAL, default="5s"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_SCAN_BUDGET, default="300ms"): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_SCAN_MERGE_RANGES, default=False): cv.boolean,
+    cv.Optional(CONF_LOW_POWER, default=False): cv.boolean,
  }).extend(cv.COMPONENT_SCHEMA)
 
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
+    cg.add(var.set_timeout_margin(config[CONF_TIMEOUT_MARGIN]))
+    cg.add(var.set_scan_min_interval(config[CONF_SCAN_MIN_INTERVAL]))
+    cg.add(var.set_scan_budget(config[CONF_SCAN_BUDGET]))
+    cg.add(var.set_scan_merge_ranges(config[CONF_SCAN_MERGE_RANGES]))
+    cg.add(var.set_low_power(config[CONF_LOW_POWER]))
+    for scan_range in config[CONF_SCAN_RANGES]:
+        cg.add(var.add_scan_range(scan_range[CONF_OFFSET], scan_range[CONF_LENGTH],
+                                  scan_range[CONF_PRIORITY], scan_range[CONF_INTERVAL]))